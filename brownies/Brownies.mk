@@ -21,7 +21,7 @@ MYDIR := $(HOME2L_SRC)/brownies
 CFLAGS_BROWNIES := -I$(MYDIR)
 LDFLAGS_BROWNIES :=
 
-SRC_BROWNIES := $(MYDIR)/brownies.C
+SRC_BROWNIES := $(MYDIR)/brownies.C $(MYDIR)/brsim.C
 
 CFLAGS += $(CFLAGS_BROWNIES)
 LDFLAGS += $(LDFLAGS_BROWNIES)
@@ -70,6 +70,8 @@ const __flash TBrFeatureRecord brFeatureRecord = {
 
   .matDim       = (MATRIX_ROWS << 4) | (MATRIX_COLS),
 
+  .protocol     = BR_PROTO_BURST,
+
   .fwName       = BROWNIE_FWNAME,
 
   .mcuType      = MCU_TYPE,
@@ -176,6 +176,8 @@ int8_t BrRequestSize (uint8_t op) {      // Total number of byte of a message (i
   if (BR_OP_IS_REG_WRITE (op)) return 3;
   if (BR_OP_IS_MEM_READ (op))  return 3;
   if (BR_OP_IS_MEM_WRITE (op)) return 3 + BR_MEM_BLOCKSIZE;
+  if (BR_OP_IS_REG_READ_BURST (op))  return 3;
+  if (BR_OP_IS_REG_WRITE_BURST (op)) return 3 + BR_OP_BURST_REGS (op);
   return 2;                             // illegal operation
 }
 
@@ -183,6 +185,7 @@ int8_t BrRequestSize (uint8_t op) {      // Total number of byte of a message (i
 int8_t BrReplySize (uint8_t op) {        // Total number of byte of a reply (including status/checksum)
   if (BR_OP_IS_REG_READ (op)) return 2;
   if (BR_OP_IS_MEM_READ (op)) return 2 + BR_MEM_BLOCKSIZE;
+  if (BR_OP_IS_REG_READ_BURST (op)) return 2 + BR_OP_BURST_REGS (op);
   return 1;                             // default (no data to return)
 }
 
@@ -213,8 +216,9 @@ EBrStatus BrRequestCheck (TBrRequest *msg, int8_t bytes) {
 
 
 void BrReplyPackage (TBrReply *reply, int8_t len) {
-  if (len > 2) reply->memRead.dataCheck = BrCalcCheck8 (&reply->memRead.data, BR_MEM_BLOCKSIZE);
-    // replies with >2 bytes are memory reads => calculate inner data check first.
+  if (len > 2) reply->regReadBurst.data[len - 2] = BrCalcCheck8 (&reply->regReadBurst.data, len - 2);
+    // replies with >2 bytes are memory reads or register bursts => calculate inner data check first
+    // (for memory reads, the check byte is 'memRead.dataCheck').
   reply->status &= 0x0f;      // clear check part of status byte (important for calculation!)
   reply->status |= BrCalcCheck4 (reply, len);
 }
@@ -235,8 +239,8 @@ EBrStatus BrReplyCheck (TBrReply *reply, uint8_t op, int8_t bytes) {
   // Checksum...
   reply->status &= 0x0f;
   if ((checkAndStatus & 0xf0) != BrCalcCheck4 (reply, len)) return brReplyCheckError;
-  if ((checkAndStatus & 0x0f) == (uint8_t) brOk && BR_OP_IS_MEM_READ(op))
-    if (reply->memRead.dataCheck != BrCalcCheck8 (&reply->memRead.data, BR_MEM_BLOCKSIZE)) return brReplyCheckError;
+  if ((checkAndStatus & 0x0f) == (uint8_t) brOk && len > 2)    // memory read or register burst read
+    if (reply->regReadBurst.data[len - 2] != BrCalcCheck8 (&reply->regReadBurst.data, len - 2)) return brReplyCheckError;
 
   // OK...
   return brOk;
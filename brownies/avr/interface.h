@@ -102,6 +102,13 @@
  * - During flash programming, no EEPROM writes are allowed.
  * - Flash writes to dangerous addresses (own code) are usually blocked out (@ref brForbidden).
  *
+ * **Notes on register bursts:**
+ * - A burst operation accesses up to BR_MEM_BLOCKSIZE consecutive registers in one transaction.
+ * - Registers are processed in ascending order, with the same side effects as single accesses.
+ * - Bursts touching the UART data registers or (writes) @ref BR_REG_FWBASE / @ref BR_REG_CTRL are
+ *   rejected (@ref brForbidden).
+ * - Only devices with @ref BR_PROTO_BURST set in their feature record support bursts.
+ *
  *
  * @{
  */
@@ -151,6 +158,10 @@ typedef struct SBrRequest {
       uint8_t adr;                    ///< (memWrite) Memory block address
       uint8_t data[BR_MEM_BLOCKSIZE]; ///< (memWrite) Data to write
     } memWrite;
+    struct {            // Register burst read/write ...
+      uint8_t reg;                    ///< (regBurst) First register
+      uint8_t data[BR_MEM_BLOCKSIZE]; ///< (regBurst) Data to write (burst writes only)
+    } regBurst;
   };
 } TBrRequest;
 
@@ -167,6 +178,9 @@ typedef struct SBrReply {
       uint8_t data[BR_MEM_BLOCKSIZE]; ///< (memRead) Data
       uint8_t dataCheck;              ///< (memRead) 8-bit checksum for 'data'
     } memRead;
+    struct {              // Register burst read ...
+      uint8_t data[BR_MEM_BLOCKSIZE + 1]; ///< (regReadBurst) Register values, followed by an 8-bit checksum
+    } regReadBurst;
   };
 } TBrReply;
 
@@ -192,12 +206,17 @@ typedef struct SBrReply {
 #define BR_OP_REG_WRITE(REG) ((0x40 | (REG)))             ///< Build "register write" opcode
 #define BR_OP_MEM_READ(BLKADR)  (0x80 | ((BLKADR) >> 8))  ///< Build "memory read" opcode
 #define BR_OP_MEM_WRITE(BLKADR) (0x90 | ((BLKADR) >> 8))  ///< Build "memory write" opcode
+#define BR_OP_REG_READ_BURST(N)  (0xa0 | ((N) - 1))       ///< Build "register burst read" opcode for N (1..16) registers
+#define BR_OP_REG_WRITE_BURST(N) (0xb0 | ((N) - 1))       ///< Build "register burst write" opcode for N (1..16) registers
 
 // Analyzing operation words ...
 #define BR_OP_IS_REG_READ(OP)  (((OP) & 0xc0) == 0x00)
 #define BR_OP_IS_REG_WRITE(OP) (((OP) & 0xc0) == 0x40)
 #define BR_OP_IS_MEM_READ(OP)  (((OP) & 0xf0) == 0x80)
 #define BR_OP_IS_MEM_WRITE(OP) (((OP) & 0xf0) == 0x90)
+#define BR_OP_IS_REG_READ_BURST(OP)  (((OP) & 0xf0) == 0xa0)
+#define BR_OP_IS_REG_WRITE_BURST(OP) (((OP) & 0xf0) == 0xb0)
+#define BR_OP_BURST_REGS(OP) (((OP) & 0x0f) + 1)         ///< Number of registers accessed by a burst operation
 
 
 
@@ -346,7 +365,9 @@ typedef struct SBrFeatureRecord {
 
   uint8_t   matDim;           ///< Matrix dimensions (Bits 7:4: rows, bits 3:0 = cols)
 
-  uint8_t   reserved[3];      ///< (reserved for future features)
+  uint8_t   protocol;         ///< Supported protocol extensions (see BR_PROTO_... masks; not part of the database record)
+
+  uint8_t   reserved[2];      ///< (reserved for future features)
 
   // Written firmware name ...
   char      fwName[12];       ///< Written name of the firmware variant (base name of the .elf file without MCU part)
@@ -362,7 +383,7 @@ typedef struct SBrFeatureRecord {
 
 #define brFeatureRecordRcVec0 offsetof (TBrFeatureRecord, features)
   ///< Offset of first byte of the feature code stored in the database (key "features") and relevant for resources.
-#define brFeatureRecordRcVec1 offsetof (TBrFeatureRecord, reserved)
+#define brFeatureRecordRcVec1 offsetof (TBrFeatureRecord, protocol)
   ///< Offset of first byte behind the feature code stored in the database (key "features") and relevant for resources.
 
 
@@ -384,6 +405,14 @@ typedef struct SBrFeatureRecord {
 #define BR_FEATURE_SHADES_1     0x0200  ///< Has shades actuator #1
 
 
+/// @}
+/// @name ... Protocol Extensions ...
+/// (for @ref SBrFeatureRecord.protocol; firmwares older than these extensions report 0)
+/// @{
+
+#define BR_PROTO_BURST          0x01    ///< Supports @ref BR_OP_REG_READ_BURST() and @ref BR_OP_REG_WRITE_BURST()
+
+
 /// @}
 /// @name ... Matrix Dimensions ...
 /// (for @ref SBrFeatureRecord.matDim)
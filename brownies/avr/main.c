@@ -241,6 +241,56 @@ static inline void HandleRegWrite () {
 
 
 
+static inline bool BurstRangeOk (uint8_t reg, uint8_t n, bool write) {
+  // Check if a burst may access the register range 'reg' ... 'reg + n - 1'.
+  if (reg > BR_REG_MAGIC + 1 - n) return false;                             // beyond register file
+  if (reg <= BR_REG_UART_TX && reg + n > BR_REG_UART_RX) return false;      // UART data registers
+  if (write && reg + n > BR_REG_FWBASE) return false;                       // system registers
+  return true;
+}
+
+
+static inline void HandleRegReadBurst () {
+  uint8_t reg = twiSlRequest.regBurst.reg;
+  uint8_t n = BR_OP_BURST_REGS (twiSlRequest.op);
+  uint8_t *dst = twiSlReply.regReadBurst.data;
+
+  if (!BurstRangeOk (reg, n, false)) {
+    twiSlReply.status = brForbidden;
+    return;
+  }
+
+  // Read registers in ascending order with the same side effects as single reads ...
+  twiSlReply.status = brOk;
+  while (n--) {
+    FOR_EACH_MODULE(, OnRegRead (reg));
+    *(dst++) = RegGet (reg++);
+  }
+}
+
+
+static inline void HandleRegWriteBurst () {
+  uint8_t reg = twiSlRequest.regBurst.reg;
+  uint8_t n = BR_OP_BURST_REGS (twiSlRequest.op);
+  uint8_t *src = twiSlRequest.regBurst.data;
+
+  if (!BurstRangeOk (reg, n, true)) {
+    twiSlReply.status = brForbidden;
+    return;
+  }
+
+  // Write registers in ascending order ...
+  while (n--) {
+    FOR_EACH_MODULE(, OnRegWrite (reg, *src));
+    reg++;
+    src++;
+  }
+}
+
+
+
+
+
 // *************************** Memory read/write *******************************
 
 
@@ -375,6 +425,8 @@ int /* __attribute__((OS_main)) */ main (void) {
       else if (BR_OP_IS_REG_WRITE (op))  HandleRegWrite ();
       else if (BR_OP_IS_MEM_READ (op))   HandleMemRead ();
       else if (BR_OP_IS_MEM_WRITE (op))  HandleMemWrite ();
+      else if (BR_OP_IS_REG_READ_BURST (op))  HandleRegReadBurst ();
+      else if (BR_OP_IS_REG_WRITE_BURST (op)) HandleRegWriteBurst ();
       else {      // undefined operation...
         twiSlReply.status = (uint8_t) brIllegalOperation;
       }
@@ -20,6 +20,8 @@
 
 # This script sets up all GPIOs defined for the machine in $HOME2L_ROOT/etc/gpio.<host name>.
 # The directory contains symlinks pointing at some entry like /sys/class/gpio/gpio<n>.
+# Symlinks pointing to a character device line (/dev/gpiochip<n>:<offset>) are skipped,
+# since such lines are requested and configured by the driver itself.
 # The links will also be read by the GPIO resources driver, which must accept the same
 # naming convention:
 #
@@ -42,6 +44,7 @@ shopt -s nullglob
 # Export all requested GPIOs...
 for GPIO in $ETC_DIR/?*.?*; do
   SYSDIR=`readlink $GPIO`
+  [[ "$SYSDIR" == /dev/* ]] && continue
   SYSROOT=${SYSDIR%/*}
   ID=${SYSDIR##*/gpio}
   echo "Exporting GPIO $ID for '${GPIO##*/}'."
@@ -58,6 +61,7 @@ done
 for GPIO in $ETC_DIR/?*.?*; do
   OPT=${GPIO##*.}
   SYSDIR=`readlink $GPIO`
+  [[ "$SYSDIR" == /dev/* ]] && continue
 
   # Analyse options...
   DIRECTION="in"
@@ -22,7 +22,7 @@ MYDIR := $(HOME2L_SRC)/resources
 CFLAGS_RC := -I$(MYDIR)
 LDFLAGS_RC := -ldl
 
-SRC_RC := $(MYDIR)/rc_core.C $(MYDIR)/rc_drivers.C $(MYDIR)/resources.C
+SRC_RC := $(MYDIR)/rc_core.C $(MYDIR)/rc_drivers.C $(MYDIR)/rc_gates.C $(MYDIR)/resources.C
 
 CFLAGS += $(CFLAGS_RC)
 LDFLAGS += $(LDFLAGS_RC)
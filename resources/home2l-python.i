@@ -213,6 +213,7 @@ _GATES_DRV = "gate"       # name of the gates driver
 
 _gatesHaveDriver = False  # mark if we already have a driver for gates
 _gatesDict = {}           # dictionary to map decorated functions to resources
+_nativeGatesDict = {}     # dictionary of native gates ('CRcGate' objects) by resource name
 
 
 ## Define a new gate.
@@ -262,6 +263,17 @@ def NewGate (rcName, rcType, rcSet, func, subscrId = None):
      inside the gate function, they usually must be contained in 'rcSet'.\n\
      It is good practice to not read out resources directly, but only rely\n\
      on the arguments passed to the gate function.\n\
+  \n\
+  Native gates: If 'func' is a string, it is compiled as an expression and the\n\
+  gate is evaluated in C++ without calling Python at all. The resources of\n\
+  'rcSet' are referenced as '$0', '$1', ..., further resources may be given by\n\
+  their URIs. Example:\n\
+  \n\
+      NewGate ('heating', rctBool, ('/host/temp', '/host/window'),\n\
+               'not hyst ($0, 19.5, 20.5) and not $1')\n\
+  \n\
+  See the C++ documentation of 'CRcExpr' for the complete syntax. Native gates\n\
+  are the preferred way for simple logic and threshold expressions.\n\
   """
 
   # Create driver and resource ...
@@ -272,6 +284,16 @@ def NewGate (rcName, rcType, rcSet, func, subscrId = None):
     _gatesHaveDriver = True
   rc = RcRegisterResource (_GATES_DRV, rcName, rcType, False)
 
+  # Native gate ...
+  if isinstance (func, str):
+    gate = CRcGate (rc)
+    if rcSet:
+      for x in _BuildRcList (rcSet): gate.AddArg (x)
+    if not gate.SetExpr (func):
+      raise ValueError ("Invalid gate expression for '" + rcName + "': " + func)
+    _nativeGatesDict[rcName] = gate     # keep a reference
+    return rc
+
   # Callback suitable for RunOnUpdate(), use closure to include 'rc' ...
   def _OnUpdateFunc (*args):
     try:              value = func (*args)
@@ -438,6 +460,7 @@ import re
 
 
 _onEventDict = {}
+_onEventsDict = {}
 _onUpdateDict = {}
 _dailyDict = {}
 
@@ -529,6 +552,45 @@ def onEvent (*rcSet):
 
 
 
+## Define a function to be called with batches of events.
+def RunOnEvents (func, rcSet, data = None, subscrId = None, coalesce = True):
+  """Define a function to be called with all events for a set of resources\n\
+  that are pending at a time.\n\
+  \n\
+  This is the batched variant of 'RunOnEvent()'. The function 'func' will be\n\
+  called as follows:\n\
+  \n\
+      func (evList [ , data ] )\n\
+  \n\
+  where 'evList' is a list of 'CRcEvent' objects in the correct order in time.\n\
+  If 'coalesce' is set, only the last 'rceValueStateChanged' event is passed\n\
+  for each resource. Handling events in batches saves a Python invocation for\n\
+  each single event and is recommended for resources with frequent updates.\n\
+  """
+  if not subscrId: subscrId = _SubscrIdFromFunc (func)
+  subscr = _BuildSubscriber (subscrId, _BuildRcList (rcSet))
+  _onEventsDict[subscrId] = (func, subscr, data, coalesce)
+
+
+## Decorator to define a function to be called with batches of events.
+def onEvents (*rcSet):
+  """Decorator variant of 'RunOnEvents()'.\n\
+  \n\
+  This decorator allows to easily let a function be executed on batches of\n\
+  events as follows:\n\
+  \n\
+  |   @onEvents (<resource set>)\n\
+  |   def MyFunc (evList):\n\
+  |     for ev in evList: ...\n\
+  \n\
+  """
+  def _Decorate (func):
+    RunOnEvents (func, rcSet)
+    return func
+  return _Decorate
+
+
+
 
 
 # ****************** RunOnUpdate() *************************
@@ -884,6 +946,55 @@ def daily (*hostSet):
 
 
 
+
+
+# ****************** Rule Statistics ***********************
+
+
+import time
+
+
+_ruleStats = {}   # per-rule execution statistics: key -> [ <calls>, <total seconds>, <max seconds> ]
+
+
+def _RuleStatsAdd (key, t0):
+  # Internal function to account a rule invocation started at 't0' (obtained by 'time.perf_counter()').
+  dt = time.perf_counter () - t0
+  st = _ruleStats.get (key)
+  if st is None: _ruleStats[key] = [ 1, dt, dt ]
+  else:
+    st[0] += 1
+    st[1] += dt
+    if dt > st[2]: st[2] = dt
+
+
+## Get the execution statistics of all rules.
+def GetRuleStats ():
+  """Get the execution statistics of all rule functions.\n\
+  \n\
+  The result is a dictionary mapping each rule (event processor type and ID,\n\
+  e.g. 'S:MyFunc' for subscribers or 'T:MyTimedFunc' for timers) to a tuple\n\
+  '(calls, totalMs, maxMs)'.\n\
+  """
+  ret = {}
+  for key, st in _ruleStats.items ():
+    ret[key] = (st[0], st[1] * 1000.0, st[2] * 1000.0)
+  return ret
+
+
+## Print the execution statistics of all rules.
+def PrintRuleStats ():
+  """Print the execution statistics of all rule functions, sorted by their total\n\
+  execution time, followed by the statistics of all native gates.\n\
+  """
+  print ("%-32s %8s %10s %10s %10s" % ("Rule", "Calls", "Total/ms", "Avg/ms", "Max/ms"))
+  for key, st in sorted (_ruleStats.items (), key = lambda x: x[1][1], reverse = True):
+    print ("%-32s %8i %10.3f %10.3f %10.3f" % (key, st[0], st[1] * 1000.0, st[1] * 1000.0 / st[0], st[2] * 1000.0))
+  for gate in _nativeGatesDict.values ():
+    print ("Native gate: " + str (gate))
+
+
+
 ## @}
 %} // %pythoncode (home2l_rules)
 
@@ -1258,12 +1369,23 @@ def Home2lIterate (maxTime = 0):
     signal.signal (signal.SIGINT, s)
   # ~ print ("### Home2lIterate(): Select done")
 
-  # Return if no event available ...
-  if not ep: return
-  ev = ep.PollEvent ()
-  if not ev: return
+  # Process the event processor and all others that became ready in the meantime ...
+  #   To not starve the caller, the number of event processors handled per call is limited.
+  n = 0
+  while ep and n < _ITERATE_MAX_PROCESSORS:
+    _Home2lProcess (ep)
+    ep = CRcEventProcessor.Select (0)
+    n += 1
+
+
+_ITERATE_MAX_PROCESSORS = 64    # maximum number of event processors handled by one 'Home2lIterate()' call
+
+
+def _Home2lProcess (ep):
+  # Internal function to process all pending events of an event processor returned by 'Select()'.
   epType = ep.TypeId ()
   epLid = ep.InstId ()
+  t0 = time.perf_counter ()
   # ~ print ("### Home2lIterate(): Event: ", epType, epLid);
 
   # Process event ...
@@ -1272,50 +1394,61 @@ def Home2lIterate (maxTime = 0):
     # Check 'RunOnEvent'...
     if epLid in _onEventDict:
       func, subscr, data = _onEventDict[epLid]
-      while ev:     # loop to quickly process many events
-        if func.__code__.co_argcount == 3:     # tolerate functions without the 'data' argument ...
-          func (ev.Type (), ev.Resource (), ev.ValueState ())
-        else:
-          func (ev.Type (), ev.Resource (), ev.ValueState (), data)
-        ev = ep.PollEvent ()
+      evList = ep.PollEvents ()
+      if not evList: return
+      withData = (func.__code__.co_argcount != 3)     # tolerate functions without the 'data' argument ...
+      for ev in evList:     # loop to quickly process many events
+        if withData: func (ev.Type (), ev.Resource (), ev.ValueState (), data)
+        else:        func (ev.Type (), ev.Resource (), ev.ValueState ())
+
+    # Check 'RunOnEvents'...
+    elif epLid in _onEventsDict:
+      func, subscr, data, coalesce = _onEventsDict[epLid]
+      evList = ep.PollEvents (coalesce)
+      if not evList: return
+      if func.__code__.co_argcount == 1: func (evList)
+      else:                              func (evList, data)
 
     # Check 'RunOnUpdate'...
     elif epLid in _onUpdateDict:
       func, subscr, rcList, funcArgs, data = _onUpdateDict[epLid]
-      lastEv = None
-      while ev:
-        if ev.Type () == rceValueStateChanged: lastEv = ev
-        ev = ep.PollEvent ()
-      if lastEv:
-        argList = []
-        # ~ print ("### rcList = " + str(rcList))
-        for rc in rcList: argList.append (rc.Value ())
-        if funcArgs != None or data != None: argList.append (data)
-          # If the function arguments are variable (as in '_OnUpdateFunc()' in 'Connect()'),
-          # we add the 'data' argument iff it is != 'None'. Otherwise, we pass as many
-          # arguments as 'func' takes.
-        if funcArgs != None: del argList[funcArgs:]     # tolerate functions with fewer arguments ...
-        # ~ print ("### Home2lIterate() on update: funcArgs = " + str(funcArgs) + ", argList = " + str(argList))
-        func (*argList)
+      changed = False
+      for ev in ep.PollEvents (True):
+        if ev.Type () == rceValueStateChanged: changed = True
+      if not changed: return
+      argList = []
+      # ~ print ("### rcList = " + str(rcList))
+      for rc in rcList: argList.append (rc.Value ())
+      if funcArgs != None or data != None: argList.append (data)
+        # If the function arguments are variable (as in '_OnUpdateFunc()' in 'Connect()'),
+        # we add the 'data' argument iff it is != 'None'. Otherwise, we pass as many
+        # arguments as 'func' takes.
+      if funcArgs != None: del argList[funcArgs:]     # tolerate functions with fewer arguments ...
+      # ~ print ("### Home2lIterate() on update: funcArgs = " + str(funcArgs) + ", argList = " + str(argList))
+      func (*argList)
 
     # Check 'RunDaily'...
     elif epLid in _dailyDict:
       func, subscr, data = _dailyDict[epLid]
       hostSet = set()
-      while ev:
+      for ev in ep.PollEvents ():
         if ev.Type () == rceValueStateChanged or ev.Type () == rceConnected:
           host = ev.Resource ().Uri ().split ('/') [2]
           hostSet.add (host)
-        ev = ep.PollEvent ()
+      if not hostSet: return
       for host in hostSet:
         if func.__code__.co_argcount == 0:   func ()
         elif func.__code__.co_argcount == 1: func (host)
         else:                                func (host, data)
     else:
       print ("WARNING: Received event on unknown subscriber '" + epLid + "'")
+      ep.PollEvents ()
+      return
 
   # Driver (driving) ...
   elif epType == 'D':
+    ev = ep.PollEvent ()
+    if not ev: return
     func, data = _driverDict[epLid]
     if func == None:
       print ("WARNING: Received drive event for '" + str (ev.Resource ()) + "', but driver has no drive function.")
@@ -1328,13 +1461,16 @@ def Home2lIterate (maxTime = 0):
   # Timer ('RunAt') ...
   elif epType == 'T':
     # ~ print ("### Home2lIterate(): Timer '" + epLid + "'")
+    if not ep.PollEvents (): return   # (overflown timer events are ignored)
     func, args, ep = _timerDict[epLid]
     if func.__code__.co_argcount == 0:    func ()       # tolerate functions without an argument
     elif func.__code__.co_argcount == 1:  func (args)   # single argument: pass unchecked
     elif isinstance (args, tuple):        func (*args)  # call with positional arguments
     elif isinstance (args, dict):         func (**args) # call with keyword arguments
     else:                                 func (args)   # call unchanged (this may fail, but will hopefully give a meaningful exception report)
-    while ev: ev = ep.PollEvent ()  # Ignore overflown timer events
+
+  # Account the rule execution ...
+  _RuleStatsAdd (epType + ':' + epLid, t0)
 
 
 ## Run the Home2L main loop indefinitely (or until stopped).